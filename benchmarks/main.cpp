@@ -0,0 +1,692 @@
+#define yyEnable_Aliases
+#define yyEnable_Benchmarking
+#define yyEnable_AsyncLog
+#define yyEnable_Tracing
+#define yyDisable_LogFileAndLine
+#define yyLib_Glm
+#include <y.hpp>
+
+
+////////////////////////////////////////////////////////////////////////////////
+//                                   LOG                                      //
+////////////////////////////////////////////////////////////////////////////////
+
+static void bench_log() {
+    usize constexpr calls = 20000;
+    Vec<Str> lines {};
+
+    auto const per_call = [&lines](StrView title, auto &&callback) {
+        Vec<f64> samples(calls);
+        for (usize i = 0; i < calls; ++i) {
+            auto const et = y::ETimer {}.reset();
+            callback(i);
+            samples[i] = et.elapsed_ns();
+        }
+        std::sort(samples.begin(), samples.end());
+        f64 total = 0.0;
+        for (auto const s : samples) {
+            total += s;
+        }
+        lines.push_back(y_fmt("⌚ {:<24} | mean {:>8.1f} ns | p50 {:>8.1f} ns | p99 {:>8.1f} ns",
+                              title, total / f64(calls), samples[calls / 2],
+                              samples[calls * 99 / 100]));
+    };
+
+    // Log records are not part of the report
+    y::log_flush();
+    y::nasty::stdout_off();
+
+    // Same expansion as 'y_info' without 'yyEnable_AsyncLog'
+    per_call("log printf (sync)", [](usize i) {
+        auto const msg = y_fmt("record {} {}", i, 3.14);
+        printf("%s", y_fmt("{}{}\n", y_fmt("[{}] | ", "INFO"), msg).c_str());
+    });
+    std::fflush(stdout);
+
+    per_call("log ring (async)", [](usize i) { y_info("record {} {}", i, 3.14); });
+    y::log_flush();
+
+    y::nasty::stdout_on();
+
+    for (auto const &line : lines) {
+        y_println("{}", line);
+    }
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+//                                  FILES                                     //
+////////////////////////////////////////////////////////////////////////////////
+
+static void bench_files() {
+    Str const path = (y::fs::temp_directory_path() / "y_bench_files.txt").string();
+    y_defer(y::fs::remove(path));
+
+    // 256 MB of short lines
+    {
+        Str block {};
+        for (usize i = 0; block.size() < (1ul << 20); ++i) {
+            block += y_fmt("{},record,{}\n", i, i * 31);
+        }
+        std::ofstream file { path, std::ios::binary | std::ios::trunc };
+        for (usize i = 0; i < 256; ++i) {
+            file.write(block.data(), std::streamsize(block.size()));
+        }
+    }
+
+    auto const count_lines = [](SpanConst<u8> bytes) {
+        return usize(std::count(bytes.begin(), bytes.end(), u8('\n')));
+    };
+
+    y::Benchmark B {};
+    B.set_warmup(1);
+    B.set_samples(5);
+    B.set_align_column(36);
+
+    B.run("file_read + count", 1, [&] {
+        Str const content = y::file_read(path);
+        return std::count(content.begin(), content.end(), '\n');
+    });
+    B.run("bin_read + count", 1, [&] { return count_lines(y::bin_read(path)); });
+    B.run("MappedFile + count", 1, [&] {
+        y::MappedFile const mapped { path };
+        mapped.advise(y::MappedFile::Access::Sequential);
+        return count_lines(mapped);
+    });
+    B.run("ChunkReader + count", 1, [&] {
+        usize lines = 0;
+        y::ChunkReader reader { path };
+        for (auto chunk = reader.next(); !chunk.empty(); chunk = reader.next()) {
+            lines += count_lines(chunk);
+        }
+        return lines;
+    });
+
+    // Small appended records
+    usize constexpr records = 10000;
+    Str const out_path = (y::fs::temp_directory_path() / "y_bench_writer.txt").string();
+    y_defer(y::fs::remove(out_path));
+
+    B.run(y_fmt("file_append x {}", records), 1, [&] {
+        for (usize i = 0; i < records; ++i) {
+            y::file_append(out_path, y_fmt("{},record\n", i));
+        }
+    });
+    B.run(y_fmt("FileWriter x {}", records), 1, [&] {
+        y::FileWriter writer { out_path };
+        for (usize i = 0; i < records; ++i) {
+            writer.write(y_fmt("{},record\n", i));
+        }
+    });
+    B.run(y_fmt("FileWriter (bg flush) x {}", records), 1, [&] {
+        y::FileWriter writer { out_path, y::FileWriter::Mode::Append, 1ul << 16, 5.0 };
+        for (usize i = 0; i < records; ++i) {
+            writer.write(y_fmt("{},record\n", i));
+        }
+    });
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+//                                 STRINGS                                    //
+////////////////////////////////////////////////////////////////////////////////
+
+// Previous implementations, kept as reference
+namespace legacy {
+
+static Str str_join(Vec<Str> const &strlist, Str const &delim) {
+    Str s;
+    s.reserve(strlist.size() + (delim.size() * strlist.size() + 4));
+    for (usize i = 0; i < strlist.size() - 1; ++i) {
+        s += strlist[i] + delim;
+    }
+    s += strlist[strlist.size() - 1];
+    return s;
+}
+
+static Str str_replace(Str str, Str const &from, Str const &to) {
+    usize pos = 0;
+    while ((pos = str.find(from)) < str.size()) {
+        str.replace(pos, from.length(), to);
+    }
+    return str;
+}
+
+} // namespace legacy
+
+static void bench_strings() {
+    // ~4 MB of CSV-like lines
+    Str csv {};
+    while (csv.size() < (4ul << 20)) {
+        csv += y_fmt("  {},alpha,{},beta;gamma  \n", csv.size(), csv.size() * 7);
+    }
+    Vec<Str> const tokens = y::str_split(csv, ",");
+
+    y::Benchmark B {};
+    B.set_warmup(1);
+    B.set_samples(5);
+    B.set_align_column(36);
+
+    B.run("str_split (Vec<Str>)", 1, [&] { return y::str_split(csv, ",").size(); });
+    B.run("str_split_view", 1, [&] {
+        usize count = 0;
+        for (auto const token : y::str_split_view(csv, ",")) {
+            count += token.size();
+        }
+        return count;
+    });
+
+    B.run("legacy::str_join", 1, [&] { return legacy::str_join(tokens, ",").size(); });
+    B.run("str_join", 1, [&] { return y::str_join(tokens, ",").size(); });
+    B.run("str_join (lazy split)", 1, [&] {
+        return y::str_join(y::str_split_view(csv, ","), ";").size();
+    });
+
+    // Legacy 'str_replace' is quadratic, keep its input small
+    Str const small = csv.substr(0, 64ul << 10);
+    B.run("legacy::str_replace (64 KB)", 1, [&] {
+        return legacy::str_replace(small, "alpha", "A").size();
+    });
+    B.run("str_replace (64 KB)", 1, [&] { return y::str_replace(small, "alpha", "A").size(); });
+    B.run("str_replace (4 MB)", 1, [&] { return y::str_replace(csv, "alpha", "A").size(); });
+
+    Vec<Str> const from = { "alpha", "beta", "gamma", ";", "\n" };
+    Vec<Str> const to = { "A", "B", "G", "|", "\r\n" };
+    B.run("str_replace x 5 (4 MB)", 1, [&] {
+        Str out = csv;
+        for (usize i = 0; i < from.size(); ++i) {
+            out = y::str_replace(out, from[i], to[i]);
+        }
+        return out.size();
+    });
+    B.run("str_replace_many_all (4 MB)", 1, [&] {
+        return y::str_replace_many_all(csv, from, to).size();
+    });
+
+    B.run("str_trim per line", 1, [&] {
+        usize size = 0;
+        for (auto const line : y::str_split_view(csv, "\n")) {
+            size += y::str_trim(line).size();
+        }
+        return size;
+    });
+    B.run("str_trim_view per line", 1, [&] {
+        usize size = 0;
+        for (auto const line : y::str_split_view(csv, "\n")) {
+            size += y::str_trim_view(line).size();
+        }
+        return size;
+    });
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+//                                  MEMORY                                    //
+////////////////////////////////////////////////////////////////////////////////
+
+static void bench_memory() {
+    // Request-sized inputs: a few dozen 'Key=Value' lines each
+    Vec<Str> requests {};
+    for (usize r = 0; r < 1000; ++r) {
+        Str body {};
+        for (usize i = 0; i < 40; ++i) {
+            body += y_fmt("Header-{}=Some Value {} with spaces\n", i, r * i);
+        }
+        requests.push_back(body);
+    }
+
+    y::Benchmark B {};
+    B.set_warmup(1);
+    B.set_samples(9);
+    B.set_align_column(40);
+
+    // Parse every line, normalize its key and value and rebuild the request
+    B.run("parse + transform (heap)", 1, [&] {
+        usize size = 0;
+        for (auto const &body : requests) {
+            Vec<Str> out {};
+            for (auto const &line : y::str_split(body, "\n")) {
+                auto const kv = y::str_split(line, "=");
+                out.push_back(y::str_lower(kv[0]) + ":" + y::str_replace(kv[1], " ", "_"));
+            }
+            size += y::str_join(out, ";").size();
+        }
+        return size;
+    });
+
+    y::Arena arena {};
+    B.run("parse + transform (arena)", 1, [&] {
+        usize size = 0;
+        for (auto const &body : requests) {
+            arena.reset();
+            PmrVec<PmrStr> out { &arena };
+            for (auto const &line : y::str_split(body, "\n", arena)) {
+                auto const kv = y::str_split(line, "=", arena);
+                auto &item = out.emplace_back(y::str_lower(kv[0], arena));
+                item += ":";
+                item += y::str_replace(kv[1], " ", "_", arena);
+            }
+            size += y::str_join(out, ";", arena).size();
+        }
+        return size;
+    });
+
+    auto const stats = arena.stats();
+    y_println("Arena: used {} B | high water {} B | capacity {} B | {} chunks | {} allocations",
+              stats.used, stats.high_water, stats.capacity, stats.chunks, stats.allocations);
+
+    y::Pool<Str> pool {};
+    B.run("new / delete x 10000", 1, [&] {
+        Vec<Str *> objs(10000);
+        for (auto &obj : objs) {
+            obj = new Str("pooled");
+        }
+        for (auto *obj : objs) {
+            delete obj;
+        }
+    });
+    B.run("Pool create / destroy x 10000", 1, [&] {
+        Vec<Str *> objs(10000);
+        for (auto &obj : objs) {
+            obj = pool.create("pooled");
+        }
+        for (auto *obj : objs) {
+            pool.destroy(obj);
+        }
+    });
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+//                                CONTAINERS                                  //
+////////////////////////////////////////////////////////////////////////////////
+
+template <typename Map, typename K>
+static void bench_map(y::Benchmark &B, StrView name, Vec<K> const &keys, Vec<K> const &misses) {
+    B.run(y_fmt("{} insert", name), 1, [&] {
+        Map map {};
+        for (usize i = 0; i < keys.size(); ++i) {
+            map[keys[i]] = i;
+        }
+        return map.size();
+    });
+
+    Map map {};
+    for (usize i = 0; i < keys.size(); ++i) {
+        map[keys[i]] = i;
+    }
+    // Not in insertion order, nodes of 'Umap' would be visited in allocation order
+    Vec<K> lookups {};
+    for (usize i = 0; i < keys.size(); ++i) {
+        lookups.push_back(keys[i * 7919 % keys.size()]);
+    }
+    B.run(y_fmt("{} lookup hit", name), 1, [&] {
+        usize sum = 0;
+        for (auto const &key : lookups) {
+            sum += map.find(key)->second;
+        }
+        return sum;
+    });
+    B.run(y_fmt("{} lookup miss", name), 1, [&] {
+        usize found = 0;
+        for (auto const &key : misses) {
+            found += map.count(key);
+        }
+        return found;
+    });
+    B.run(y_fmt("{} iterate", name), 1, [&] {
+        usize sum = 0;
+        for (auto const &[key, value] : map) {
+            sum += value;
+        }
+        return sum;
+    });
+    // Same inserts as above followed by erasing every key ('insert' is the cost to subtract)
+    B.run(y_fmt("{} insert + erase", name), 1, [&] {
+        Map churn {};
+        for (usize i = 0; i < keys.size(); ++i) {
+            churn[keys[i]] = i;
+        }
+        for (auto const &key : keys) {
+            churn.erase(key);
+        }
+        return churn.size();
+    });
+}
+
+static void bench_containers() {
+    constexpr usize count = 100000;
+    Vec<u64> ints(count), int_misses(count);
+    Vec<Str> strs(count), str_misses(count);
+    auto const scatter = [](u64 x) { // splitmix64 finalizer, a bijection: no duplicates
+        x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ull;
+        x = (x ^ (x >> 27)) * 0x94D049BB133111EBull;
+        return x ^ (x >> 31);
+    };
+    for (usize i = 0; i < count; ++i) {
+        ints[i] = scatter(i);
+        int_misses[i] = scatter(count + i);
+        strs[i] = y_fmt("user_{}_session", ints[i]);
+        str_misses[i] = y_fmt("user_{}_session", int_misses[i]);
+    }
+
+    y::Benchmark B {};
+    B.set_warmup(1);
+    B.set_samples(9);
+    B.set_align_column(40);
+
+    bench_map<Umap<u64, usize>>(B, "Umap<u64>", ints, int_misses);
+    bench_map<y::FlatMap<u64, usize>>(B, "FlatMap<u64>", ints, int_misses);
+    bench_map<Umap<Str, usize>>(B, "Umap<Str>", strs, str_misses);
+    bench_map<y::FlatMap<Str, usize>>(B, "FlatMap<Str>", strs, str_misses);
+
+    B.run("Uset<u64> insert + lookup", 1, [&] {
+        Uset<u64> set {};
+        for (auto key : ints) {
+            set.insert(key);
+        }
+        return std::count_if(ints.begin(), ints.end(), [&](u64 key) { return set.contains(key); });
+    });
+    B.run("FlatSet<u64> insert + lookup", 1, [&] {
+        y::FlatSet<u64> set {};
+        for (auto key : ints) {
+            set.insert(key);
+        }
+        return std::count_if(ints.begin(), ints.end(), [&](u64 key) { return set.contains(key); });
+    });
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+//                                   SIMD                                     //
+////////////////////////////////////////////////////////////////////////////////
+
+static void bench_simd() {
+    using y::simd::Level;
+
+    // ~16 MB of mixed case text
+    Str text {};
+    while (text.size() < (16ul << 20)) {
+        text += y_fmt("  Some Mixed CASE Record {} With, Fields.\n", text.size());
+    }
+    Str const needle = "NEEDLE at the end";
+    text += needle;
+
+    y::Benchmark B {};
+    B.set_warmup(1);
+    B.set_samples(7);
+    B.set_align_column(40);
+
+    B.run("std::transform ::tolower", 1, [&] {
+        Str str = text;
+        std::transform(str.begin(), str.end(), str.begin(), ::tolower);
+        return str.size();
+    });
+
+    for (auto const lvl : { Level::Scalar, Level::Sse2, Level::Avx2 }) {
+        if (lvl > y::simd::detected()) {
+            continue;
+        }
+        y::simd::set_level(lvl);
+        StrView const name = lvl == Level::Avx2 ? "avx2" : lvl == Level::Sse2 ? "sse2" : "scalar";
+
+        B.run(y_fmt("str_lower [{}]", name), 1, [&] { return y::str_lower(text).size(); });
+        B.run(y_fmt("str_upper [{}]", name), 1, [&] { return y::str_upper(text).size(); });
+        B.run(y_fmt("str_contains [{}]", name), 1, [&] {
+            return y::str_contains(text, needle);
+        });
+        B.run(y_fmt("count_byte '\\n' [{}]", name), 1, [&] {
+            return y::simd::count_byte(text, '\n');
+        });
+        B.run(y_fmt("is_ascii [{}]", name), 1, [&] { return y::simd::is_ascii(text); });
+        B.run(y_fmt("str_trim_view per line [{}]", name), 1, [&] {
+            usize size = 0;
+            for (auto const line : y::str_split_view(text, "\n")) {
+                size += y::str_trim_view(line).size();
+            }
+            return size;
+        });
+    }
+
+    y::simd::set_level(y::simd::detected());
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+//                                   MATH                                     //
+////////////////////////////////////////////////////////////////////////////////
+
+static void bench_math() {
+    using y::simd::Level;
+
+    // 1M values / vectors, a third of them close to (or aligned with) their pair
+    usize constexpr count = 1ul << 20;
+    auto const value = [](usize i) { return f32(u32(i * 2654435761u) % 20000) * 0.1f - 1000.f; };
+    Vec<f32> a(count), b(count);
+    Vec<Vec3> va(count), vb(count);
+    for (usize i = 0; i < count; ++i) {
+        a[i] = value(i);
+        b[i] = i % 3 ? value(i + count) : a[i] + 0.001f;
+        va[i] = { value(3 * i), value(3 * i + 1), value(3 * i + 2) };
+        vb[i] = i % 3 ? Vec3 { value(i), value(i + 1), value(i + 2) }
+                      : Vec3 { va[i].x * 2.f, va[i].y * 2.f, va[i].z * 2.f };
+    }
+    y::Vec3Soa const sa { va }, sb { vb };
+    Vec<u8> mask(count);
+    Vec<f32> out(count);
+
+    y::Benchmark B {};
+    B.set_warmup(1);
+    B.set_samples(9);
+    B.set_align_column(40);
+
+    // Per-element loops, as written without the batch API
+    B.run("loop fuzzy_eq (f32)", 1, [&] {
+        for (usize i = 0; i < count; ++i) {
+            mask[i] = y::fuzzy_eq(a[i], b[i]);
+        }
+        return mask[count / 2];
+    });
+    B.run("loop fuzzy_eq (Vec3)", 1, [&] {
+        for (usize i = 0; i < count; ++i) {
+            mask[i] = y::fuzzy_eq(va[i], vb[i]);
+        }
+        return mask[count / 2];
+    });
+    B.run("loop is_aligned (Vec3)", 1, [&] {
+        for (usize i = 0; i < count; ++i) {
+            mask[i] = y::is_aligned(va[i], vb[i]);
+        }
+        return mask[count / 2];
+    });
+    B.run("loop clamp", 1, [&] {
+        for (usize i = 0; i < count; ++i) {
+            out[i] = y::clamp(a[i], -10.f, 10.f);
+        }
+        return out[count / 2];
+    });
+    B.run("loop map", 1, [&] {
+        for (usize i = 0; i < count; ++i) {
+            out[i] = y::map(a[i], -1000.f, 1000.f, 0.f, 1.f);
+        }
+        return out[count / 2];
+    });
+    B.run("loop clamp_angle", 1, [&] {
+        for (usize i = 0; i < count; ++i) {
+            out[i] = y::clamp_angle(a[i]);
+        }
+        return out[count / 2];
+    });
+
+    for (auto const lvl : { Level::Scalar, Level::Sse2, Level::Avx2 }) {
+        if (lvl > y::simd::detected()) {
+            continue;
+        }
+        y::simd::set_level(lvl);
+        StrView const name = lvl == Level::Avx2 ? "avx2" : lvl == Level::Sse2 ? "sse2" : "scalar";
+
+        B.run(y_fmt("batch::fuzzy_eq (f32) [{}]", name), 1, [&] {
+            y::batch::fuzzy_eq(a, b, mask);
+            return mask[count / 2];
+        });
+        B.run(y_fmt("batch::fuzzy_eq (Vec3) [{}]", name), 1, [&] {
+            y::batch::fuzzy_eq(va, vb, mask);
+            return mask[count / 2];
+        });
+        B.run(y_fmt("batch::fuzzy_eq (Vec3Soa) [{}]", name), 1, [&] {
+            y::batch::fuzzy_eq(sa, sb, mask);
+            return mask[count / 2];
+        });
+        B.run(y_fmt("batch::is_aligned (Vec3) [{}]", name), 1, [&] {
+            y::batch::is_aligned(va, vb, mask);
+            return mask[count / 2];
+        });
+        B.run(y_fmt("batch::is_aligned (Vec3Soa) [{}]", name), 1, [&] {
+            y::batch::is_aligned(sa, sb, mask);
+            return mask[count / 2];
+        });
+        B.run(y_fmt("batch::clamp [{}]", name), 1, [&] {
+            y::batch::clamp(a, out, -10.f, 10.f);
+            return out[count / 2];
+        });
+        B.run(y_fmt("batch::map [{}]", name), 1, [&] {
+            y::batch::map(a, out, -1000.f, 1000.f, 0.f, 1.f);
+            return out[count / 2];
+        });
+        B.run(y_fmt("batch::clamp_angle [{}]", name), 1, [&] {
+            y::batch::clamp_angle(a, out);
+            return out[count / 2];
+        });
+    }
+
+    y::simd::set_level(y::simd::detected());
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//                                  THREADS                                   //
+////////////////////////////////////////////////////////////////////////////////
+
+static void bench_threads() {
+    Vec<f64> values(1ul << 22);
+    for (usize i = 0; i < values.size(); ++i) {
+        values[i] = f64(i % 1000) * 0.001;
+    }
+
+    y::Benchmark B {};
+    B.set_warmup(1);
+    B.set_samples(9);
+    B.set_align_column(40);
+
+    // Plain loops as the baseline
+    auto const base_for = B.run("for [serial]", 1, [&] {
+        for (auto &v : values) {
+            v = std::sqrt(v * v + 1.0) - 1.0;
+        }
+    });
+    auto const base_reduce = B.run("reduce [serial]", 1, [&] {
+        f64 sum = 0.0;
+        for (f64 const v : values) {
+            sum += std::sin(v);
+        }
+        return sum;
+    });
+    y_println("");
+
+    // Scaling from 2 threads to all of them (doubling). The caller works too: 'size() + 1'
+    u32 const max_workers = std::max(std::thread::hardware_concurrency(), 2u) - 1;
+    for (u32 workers = 1;; workers = std::min(workers * 2 + 1, max_workers)) {
+        y::ThreadPool pool { workers };
+        usize const threads = pool.size() + 1;
+
+        auto const stats_for = B.run(y_fmt("parallel_for [{} threads]", threads), 1, [&] {
+            pool.parallel_for(values, [](f64 &v) { v = std::sqrt(v * v + 1.0) - 1.0; });
+        });
+        auto const stats_reduce = B.run(y_fmt("parallel_reduce [{} threads]", threads), 1, [&] {
+            return pool.parallel_reduce(
+                values, 0.0, [](f64 v) { return std::sin(v); }, std::plus<f64> {});
+        });
+
+        y_println("Speedup [{} threads]: for {:.2f}x | reduce {:.2f}x\n", threads,
+                  base_for.median_ns / stats_for.median_ns,
+                  base_reduce.median_ns / stats_reduce.median_ns);
+
+        if (workers == max_workers) {
+            break;
+        }
+    }
+
+    // Many small tasks, work stealing under load
+    y::ThreadPool pool {};
+    B.run(y_fmt("submit + get x 10000 [{} workers]", pool.size()), 1, [&] {
+        Vec<std::future<usize>> futures {};
+        futures.reserve(10000);
+        for (usize i = 0; i < 10000; ++i) {
+            futures.push_back(pool.submit([i] { return i * i; }));
+        }
+        usize sum = 0;
+        for (auto &future : futures) {
+            sum += future.get();
+        }
+        return sum;
+    });
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+//                                  TRACING                                   //
+////////////////////////////////////////////////////////////////////////////////
+
+static void bench_tracing() {
+    y::Benchmark B {};
+    B.set_warmup(1);
+    B.set_samples(9);
+    B.set_align_column(40);
+
+    // Fixed iterations: every scope is kept in memory until exit
+    B.run("Clock::now x 2", 100000, [] {
+        auto const begin = Clock::now();
+        y::do_not_optimize(begin);
+        return Clock::now();
+    });
+    B.run("ticks x 2", 100000, [] {
+        auto const begin = y::ticks();
+        y::do_not_optimize(begin);
+        return y::ticks();
+    });
+    B.run("y_trace_scope", 100000, [] { y_trace_scope("bench_tracing"); });
+    B.run("y_trace_counter", 100000, [] { y_trace_counter("bench_counter", 1); });
+
+    y::trace_clear();
+    for (i32 i = 0; i < 1000; ++i) {
+        y_trace_scope("outer");
+        for (i32 j = 0; j < 10; ++j) {
+            y_trace_scope("inner");
+            y::do_not_optimize(i * j);
+        }
+    }
+    y::trace_print_summary();
+}
+
+
+int main(int argc, char *argv[]) {
+    StrView const only = argc > 1 ? argv[1] : "";
+
+    auto const run = [&](StrView name, void (*bench)()) {
+        if (only.empty() || only == name) {
+            y_println("\n# {}\n", name);
+            bench();
+        }
+    };
+
+    run("log", bench_log);
+    run("files", bench_files);
+    run("strings", bench_strings);
+    run("memory", bench_memory);
+    run("containers", bench_containers);
+    run("simd", bench_simd);
+    run("math", bench_math);
+    run("threads", bench_threads);
+    run("tracing", bench_tracing);
+
+    y::log_flush();
+}
@@ -0,0 +1,170 @@
+#define yyEnable_Aliases
+#define yyEnable_Testing
+#define yyEnable_AsyncLog
+#define yyDisable_LogFileAndLine
+#include <y.hpp>
+
+#ifdef _WIN32
+#include <fcntl.h>
+#include <io.h>
+#define pipe(fds) _pipe(fds, 1 << 16, _O_BINARY)
+#define dup _dup
+#define dup2 _dup2
+#define read _read
+#define close _close
+#endif
+
+/// Redirects fd 1 to a pipe. Without 'drain' the pipe isn't read until 'drain' (or 'finish') is
+/// called, so the log writer stalls once it's full
+class StdoutCapture {
+public:
+    explicit StdoutCapture(b8 drain_now = true) {
+        y::log_flush();
+        std::fflush(stdout);
+        std::ignore = pipe(m_fds);
+        m_saved = dup(1);
+        dup2(m_fds[1], 1);
+        if (drain_now) {
+            drain();
+        }
+    }
+
+    void drain() {
+        m_reader = std::thread([this] {
+            char buf[4096];
+            for (auto n = read(m_fds[0], buf, sizeof(buf)); n > 0; n = read(m_fds[0], buf, 4096)) {
+                m_out.append(buf, usize(n));
+            }
+        });
+    }
+
+    /// Restores fd 1 and returns the captured lines
+    Vec<Str> finish() {
+        if (!m_reader.joinable()) {
+            drain();
+        }
+        y::log_flush();
+        dup2(m_saved, 1);
+        close(m_saved);
+        close(m_fds[1]);
+        m_reader.join();
+        close(m_fds[0]);
+
+        Vec<Str> lines {};
+        for (auto const line : y::str_split_view(m_out, "\n")) {
+            lines.emplace_back(line);
+        }
+        if (!lines.empty() && lines.back().empty()) {
+            lines.pop_back();
+        }
+        return lines;
+    }
+
+    Str const &raw() const { return m_out; }
+
+private:
+    int m_fds[2] {};
+    int m_saved = -1;
+    std::thread m_reader {};
+    Str m_out {};
+};
+
+int main() {
+
+    y::Test T {};
+
+
+    T.make_section("Async Log");
+    {
+        T.test("Flush Empty", [] {
+            y::log_flush();
+            return true;
+        });
+
+        StdoutCapture capture {};
+        for (i32 i = 0; i < 10000; ++i) {
+            y_debug("async record {}", i);
+        }
+        auto lines = capture.finish();
+        T.eq("Flush Many Count", lines.size(), 10000ul);
+        b8 ordered = lines.size() == 10000;
+        for (usize i = 0; ordered && i < lines.size(); ++i) {
+            ordered = lines[i] == y_fmt("[DEBG] | async record {}", i);
+        }
+        T.ok("Flush Many Ordered", ordered);
+    }
+    {
+        StdoutCapture capture {};
+        Vec<std::thread> threads {};
+        for (i32 t = 0; t < 4; ++t) {
+            threads.emplace_back([t] {
+                for (i32 i = 0; i < 2000; ++i) {
+                    y_info("thread {} record {}", t, i);
+                }
+            });
+        }
+        for (auto &thread : threads) {
+            thread.join();
+        }
+        auto const lines = capture.finish();
+        T.eq("Many Threads Count", lines.size(), 8000ul);
+
+        // Records of the same thread keep their order
+        Arr<i32, 4> next {};
+        b8 ordered = true;
+        for (auto const &line : lines) {
+            i32 t = -1, i = -1;
+            ordered &= std::sscanf(line.c_str(), "[INFO] | thread %d record %d", &t, &i) == 2;
+            ordered &= t >= 0 && t < 4 && next[usize(t)]++ == i;
+        }
+        T.ok("Many Threads Ordered", ordered && next == Arr<i32, 4> { 2000, 2000, 2000, 2000 });
+    }
+    {
+        StdoutCapture capture {};
+        y_warn("{}", Str(4 * y::z::s_log_record_size, 'x'));
+        y_info("after");
+        auto const lines = capture.finish();
+        T.eq("Truncate Lines", lines.size(), 2ul);
+        T.eq("Truncate Length", capture.raw().find('\n') + 1, y::z::s_log_record_size);
+        T.ok("Truncate Prefix", capture.raw().starts_with("[WARN] | xxx"));
+        T.eq("Truncate Keeps Next", lines.back(), "[INFO] | after");
+    }
+    {
+        // Nobody reads the pipe: the writer blocks once it's full and the ring fills up. Far more
+        // records than the pipe, the write batch and the ring can hold are pushed
+        usize constexpr records = 4 * y::z::s_log_capacity;
+        Str const payload(400, 'o');
+
+        y::log_set_overflow(y::LogOverflow::Count);
+        StdoutCapture capture { false };
+        for (usize i = 0; i < records; ++i) {
+            y_println("overflow {}", payload);
+        }
+        usize const dropped = y::log_dropped();
+        y::log_set_overflow(y::LogOverflow::Block);
+        capture.drain();
+        y_println("overflow end");
+        auto const lines = capture.finish();
+
+        usize written = 0;
+        usize reported = 0;
+        b8 end = false;
+        for (auto const &line : lines) {
+            written += line.starts_with("overflow o");
+            end |= line == "overflow end";
+            usize count = 0;
+            if (std::sscanf(line.c_str(), "[WARN] | Async log dropped %zu records", &count) == 1) {
+                reported += count;
+            }
+        }
+        T.gt("Overflow Dropped", dropped, 0ul);
+        T.eq("Overflow Accounted", written + y::log_dropped(), records);
+        T.eq("Overflow Reported", reported, y::log_dropped());
+        T.ok("Overflow Block After", end);
+    }
+
+
+    T.show_results();
+    y::log_flush();
+    return T.cli_result();
+}
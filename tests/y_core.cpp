@@ -3,11 +3,14 @@
 #define yyLib_Fmt
 #define yyEnable_Aliases
 #define yyEnable_Testing
+#define yyEnable_Benchmarking
 #define yyLib_Glm
 // #define yyEnable_PrintFileAndLine
 #define yyDisable_LogFileAndLine
 #include <y.hpp>
 
+#include <random>
+
 int main() {
 
     y::Test T {};
@@ -188,11 +191,39 @@ int main() {
             T.eq("Replace Many Sorted", y::str_replace_many(s, from, to, true), s_ok);
         }
 
+        {
+            T.eq("Replace Grows", y::str_replace("a.b.c", ".", ".."), "a..b..c");
+            T.eq("Replace Empty From", y::str_replace("abc", "", "x"), "abc");
+
+            Vec<Str> const from = { "he", "she", "hers", "his" };
+            Vec<Str> const to = { "1", "2", "3", "4" };
+            T.eq("Replace Many All", y::str_replace_many_all("ushers his she", from, to),
+                 "u2rs 4 2");
+            T.eq("Replace Many Longest", y::str_replace_many_all("hers", from, to), "3");
+            T.eq("Replace Many Grows", y::str_replace_many_all("aXa", { "a" }, { "aa" }), "aaXaa");
+            T.eq("Replace Many Bad Sizes", y::str_replace_many_all("abc", { "a" }, {}), "abc");
+
+            y::StrReplacer const replacer { from, to };
+            T.eq("Replacer Reuse", replacer.apply("he is his"), "1 is 4");
+        }
+
         {
             Str const s = "1,2,3,4,5";
             Vec<Str> const s_res = { "1", "2", "3", "4", "5" };
             T.ok("Split", y::str_split(s, ",") == s_res);
             T.ok("Join", y::str_join(s_res, ",") == s);
+
+            Vec<StrView> views {};
+            for (auto const token : y::str_split_view(s, ",")) {
+                views.push_back(token);
+            }
+            T.eq("Split View", y_fmt("{}", views), y_fmt("{}", s_res));
+            T.ok("Split View Points Into", views[2].data() == s.data() + 4);
+            T.eq("Join Views", y::str_join(views, " "), "1 2 3 4 5");
+            T.eq("Join Lazy", y::str_join(y::str_split_view(s, ","), ""), "12345");
+
+            T.eq("Split Inner Empty", y::str_split("a,,b,", ",").size(), 3ul);
+            T.eq("Split Empty Delim", y::str_split("a,b", "").size(), 0ul);
         }
 
         {
@@ -208,7 +239,440 @@ int main() {
 
             // yInfo("==> {}", y::str_trim("***aaa***", "***"));
             T.eq("Trim Not Space", y::str_trim("***aaa***", "***"), "aaa");
+            T.eq("Trim All", y::str_trim("  \n "), "");
+            T.eq("Trim View", y::str_trim_view(" \taaa \n"), "aaa");
+        }
+    }
+
+
+    T.make_section("SIMD");
+    {
+        using y::simd::Level;
+        namespace scalar = y::simd::scalar;
+
+        std::mt19937 rng { 42 };
+        auto const random_str = [&rng](usize max_size) {
+            StrView constexpr alphabet = "aAzZ@[`{ \t\n,.-\x80\xff";
+            Str str(rng() % (max_size + 1), ' ');
+            for (auto &c : str) {
+                c = alphabet[rng() % alphabet.size()];
+            }
+            return str;
+        };
+
+        for (auto const lvl : { Level::Scalar, Level::Sse2, Level::Avx2 }) {
+            if (lvl > y::simd::detected()) {
+                continue;
+            }
+            y::simd::set_level(lvl);
+
+            u32 fails = 0;
+            for (u32 i = 0; i < 2000; ++i) {
+                Str const str = random_str(150);
+                Str const sub = random_str(i % 2 ? 2 : 5);
+                StrView const set = StrView(" \t\n,.-aA").substr(0, rng() % 10);
+                char const c = sub.empty() ? 'a' : sub[0];
+
+                Str lower = str, lower_ref = str, upper = str, upper_ref = str;
+                y::simd::ascii_lower(lower.data(), lower.size());
+                scalar::ascii_lower(lower_ref.data(), lower_ref.size());
+                y::simd::ascii_upper(upper.data(), upper.size());
+                scalar::ascii_upper(upper_ref.data(), upper_ref.size());
+                fails += lower != lower_ref || upper != upper_ref;
+
+                fails += y::simd::find(str, sub) != scalar::find(str, sub);
+                fails += y::simd::find_byte(str, c) != scalar::find_byte(str, c);
+                fails += y::simd::find_first_not_of(str, set) !=
+                         scalar::find_first_not_of(str, set);
+                fails += y::simd::find_last_not_of(str, set) != scalar::find_last_not_of(str, set);
+                fails += y::simd::count_byte(str, c) != scalar::count_byte(str, c);
+                fails += y::simd::is_ascii(str) != scalar::is_ascii(str);
+
+                Str other = str;
+                if (!other.empty() && rng() % 2) {
+                    other[rng() % other.size()] ^= 1;
+                }
+                auto const size = str.size();
+                fails += y::simd::equal(str.data(), other.data(), size) !=
+                         scalar::equal(str.data(), other.data(), size);
+            }
+            T.eq(y_fmt("Random Equivalence (Level {})", u32(lvl)), fails, 0u);
+
+            // Long enough to overflow the per-lane counters many times
+            Str const big = random_str(1ul << 18) + Str(100'000, '\n');
+            T.eq(y_fmt("Count Big (Level {})", u32(lvl)), y::simd::count_byte(big, '\n'),
+                 scalar::count_byte(big, '\n'));
+            T.eq(y_fmt("Count Big Same (Level {})", u32(lvl)),
+                 y::simd::count_byte(StrView(big).substr(big.size() - 100'000), '\n'), 100'000ul);
+        }
+
+        y::simd::set_level(y::simd::detected());
+        T.ok("Is Ascii", y::simd::is_ascii(Str(100, 'a')));
+        T.ok("Is Not Ascii", !y::simd::is_ascii(Str(100, '\x80')));
+        T.eq("Count Lines", y::simd::count_byte(Str(1000, '\n'), '\n'), 1000ul);
+    }
+
+
+    T.make_section("Memory");
+    {
+        y::Arena arena { 256 };
+
+        auto *a = arena.make<u8>(u8(1));
+        auto *b = arena.make<f64>(2.0);
+        T.ok("Arena Aligned", uintptr_t(b) % alignof(f64) == 0 && *a == 1 && *b == 2.0);
+        T.ok("Arena Over Aligned", uintptr_t(arena.alloc(1, 64)) % 64 == 0);
+
+        auto const ints = arena.make_array<i32>(16);
+        T.ok("Arena Array Zeroed", std::all_of(ints.begin(), ints.end(), [](i32 i) { return !i; }));
+        T.eq("Arena Copy", arena.copy("abc"), "abc");
+
+        auto const mark = arena.mark();
+        auto const used = arena.stats().used;
+        std::ignore = arena.alloc(1000); // Bigger than a chunk
+        T.gt("Arena Grows", arena.stats().chunks, 1ul);
+        arena.rewind(mark);
+        T.eq("Arena Rewind", arena.stats().used, used);
+
+        auto const high_water = arena.stats().high_water;
+        auto const capacity = arena.stats().capacity;
+        arena.reset();
+        T.eq("Arena Reset", arena.stats().used, 0ul);
+        T.eq("Arena Reset Keeps Chunks", arena.stats().capacity, capacity);
+        T.eq("Arena High Water", arena.stats().high_water, high_water);
+
+        PmrVec<i32> pmr_vec { &arena };
+        for (i32 i = 0; i < 100; ++i) {
+            pmr_vec.push_back(i);
+        }
+        T.eq("Pmr Vec", pmr_vec.back(), 99);
+        T.eq("Pmr Allocates On Arena", arena.stats().allocations > 0, true);
+        arena.release();
+        T.eq("Arena Release", arena.stats().capacity, 0ul);
+    }
+    {
+        y::Arena arena {};
+        StrView const s = "Ab,cD,eF";
+
+        T.eq("Arena Lower", StrView(y::str_lower(s, arena)), y::str_lower(Str(s)));
+        T.eq("Arena Upper", StrView(y::str_upper(s, arena)), y::str_upper(Str(s)));
+        T.eq("Arena Capital", StrView(y::str_capital(s, arena)), y::str_capital(Str(s)));
+        T.eq("Arena Replace", StrView(y::str_replace(s, ",", ";;", arena)),
+             y::str_replace(s, ",", ";;"));
+        T.eq("Arena Replace Many", y::str_replace_many_all(s, { "A", "D" }, { "1", "2" }, arena),
+             "1b,c2,eF");
+
+        auto const tokens = y::str_split(s, ",", arena);
+        T.eq("Arena Split", tokens.size(), 3ul);
+        T.ok("Arena Split Propagates", tokens[1].get_allocator().resource() == &arena);
+        T.eq("Arena Join", y::str_join(tokens, "-", arena), "Ab-cD-eF");
+
+        auto const content = y::file_read("./tests/input/to_file_read.txt", arena);
+        T.eq("Arena File Read", StrView(content), y::file_read("./tests/input/to_file_read.txt"));
+    }
+    {
+        struct Obj {
+            i32 v;
+            Str s;
+        };
+        y::Pool<Obj> pool { 4 };
+        Vec<Obj *> objs {};
+        for (i32 i = 0; i < 6; ++i) {
+            objs.push_back(pool.create(i, "obj"));
+        }
+        T.eq("Pool Size", pool.size(), 6ul);
+        T.eq("Pool Capacity", pool.capacity(), 8ul);
+        T.eq("Pool Construct", objs[5]->v, 5);
+
+        auto *const reused = objs[2];
+        pool.destroy(objs[2]);
+        T.ok("Pool Reuses Slot", pool.create(7, "new") == reused);
+        for (auto *obj : objs) {
+            pool.destroy(obj);
+        }
+        T.eq("Pool Empty", pool.size(), 0ul);
+        T.eq("Pool High Water", pool.high_water(), 6ul);
+    }
+
+
+    T.make_section("Flat Containers");
+    {
+        y::FlatMap<Str, i32> map { { "one", 1 }, { "two", 2 } };
+        T.eq("Map Init", map.size(), 2ul);
+        T.eq("Map At", map.at("two"), 2);
+        T.ok("Map Heterogeneous Find", map.find(StrView("one")) != map.end());
+        T.ok("Map Contains", !map.contains("three"));
+        T.eq("Map Emplace", map.emplace("one", 10).second, false);
+        map["three"] = 3;
+        T.eq("Map Subscript", map.at("three"), 3);
+        map.insert_or_assign("one", 11);
+        T.eq("Map Assign", map.at("one"), 11);
+
+        b8 thrown = false;
+        try {
+            std::ignore = map.at("four");
+        } catch (std::out_of_range const &) {
+            thrown = true;
+        }
+        T.ok("Map At Throws", thrown);
+
+        T.eq("Map Erase Key", map.erase("two"), 1ul);
+        T.eq("Map Erase Missing", map.erase("two"), 0ul);
+        T.eq("Map Fmt", y_fmt("{}", y::FlatMap<i32, Str> { { 1, "a" } }), "{ 1: a }");
+
+        auto copy = map;
+        copy["four"] = 4;
+        T.eq("Map Copy", map.size() + 1, copy.size());
+        auto moved = std::move(copy);
+        T.eq("Map Move", moved.at("four"), 4);
+    }
+    {
+        y::FlatMap<i32, i32> map {};
+        Umap<i32, i32> ref {};
+        for (i32 i = 0; i < 10000; ++i) {
+            i32 const key = (i * 7919) % 3000;
+            if (i % 3 == 2) {
+                T.eq("Map Random Erase", map.erase(key), ref.erase(key));
+            } else {
+                map[key] = i;
+                ref[key] = i;
+            }
+        }
+        T.eq("Map Random Size", map.size(), ref.size());
+        T.ok("Map Random Items", std::all_of(map.begin(), map.end(), [&](auto const &kv) {
+                 return ref.at(kv.first) == kv.second;
+             }));
+
+        for (auto it = map.begin(); it != map.end();) {
+            it = it->first % 2 ? map.erase(it) : std::next(it);
+        }
+        T.ok("Map Erase Iterating", std::all_of(map.begin(), map.end(), [](auto const &kv) {
+                 return kv.first % 2 == 0;
+             }));
+
+        usize const size = map.size();
+        map.reserve(100000);
+        T.gt("Map Reserve", map.bucket_count(), 100000ul);
+        map.rehash(0);
+        T.eq("Map Rehash Shrinks", map.size(), size);
+        T.ok("Map Load Factor", map.load_factor() <= map.max_load_factor());
+        T.eq("Map Rehash Keeps Items", map.at(0), ref.at(0));
+    }
+    {
+        y::FlatSet<Str> set { "a", "b", "a" };
+        T.eq("Set Init", set.size(), 2ul);
+        T.eq("Set Insert", set.insert(StrView("c")).second, true);
+        T.ok("Set Contains", set.contains("c") && !set.contains("d"));
+        T.eq("Set Erase", set.erase("a"), 1ul);
+        T.eq("Set Fmt Size", y_fmt("{}", set).size(), StrView("{ b, c }").size());
+    }
+
+
+    T.make_section("Math Batch");
+    {
+        T.eq("Clamp", y::clamp(15, 0, 10), 10);
+        T.eq("Clamp Angle", y::clamp_angle(-30.f), 330.f);
+
+        std::mt19937 rng { 42 };
+        std::uniform_real_distribution<f32> dist { -1000.f, 1000.f };
+        usize constexpr n = 1037; // Not a multiple of the vector widths
+
+        Vec<f32> a(n), b(n);
+        Vec<Vec3> va(n), vb(n);
+        for (usize i = 0; i < n; ++i) {
+            a[i] = dist(rng);
+            b[i] = i % 3 ? dist(rng) : a[i] + 0.001f;
+            va[i] = { dist(rng), dist(rng), dist(rng) };
+            vb[i] = i % 3 ? Vec3 { dist(rng), dist(rng), dist(rng) }
+                          : Vec3 { va[i].x * -2.f, va[i].y * -2.f, va[i].z * -2.f };
+        }
+        va[5] = Vec3 { 0.f, 0.f, 0.f }; // Zero vectors aren't aligned with anything
+
+        // Squaring their components underflows / overflows (the per-element helper too, on huge)
+        Arr<std::tuple<Vec3, Vec3, u8>, 5> const extremes { {
+            { { 1e-13f, 2e-13f, -3e-13f }, { -2e-13f, -4e-13f, 6e-13f }, 1 },
+            { { 1e-13f, 0.f, 0.f }, { 0.f, 1e-13f, 0.f }, 0 },
+            { { 1e25f, -2e25f, 3e25f }, { 5e24f, -1e25f, 1.5e25f }, 1 },
+            { { 1e25f, 0.f, 0.f }, { 1e25f, 1e25f, 0.f }, 0 },
+            { { 1e-13f, 1e-13f, 0.f }, { 1e25f, 1e25f, 0.f }, 1 },
+        } };
+        usize constexpr extremes_at = 16; // Within the vectorized part on every level
+        for (usize e = 0; e < extremes.size(); ++e) {
+            va[extremes_at + e] = std::get<0>(extremes[e]);
+            vb[extremes_at + e] = std::get<1>(extremes[e]);
         }
+        y::Vec3Soa const sa { va }, sb { vb };
+        T.ok("Soa Roundtrip", sa.to_aos() == va && sa[7] == va[7]);
+
+        Vec<f32> const edges = { std::numeric_limits<f32>::quiet_NaN(), 0.f, -0.f, 8388609.f,
+                                 -8388609.f, 3e9f, -3e9f, -0.5f };
+        a.insert(a.end(), edges.begin(), edges.end());
+        b.insert(b.end(), edges.begin(), edges.end());
+        auto const same = [](f32 lhs, f32 rhs) { // Bit for bit, any NaN
+            return std::bit_cast<u32>(lhs) == std::bit_cast<u32>(rhs) || (lhs != lhs && rhs != rhs);
+        };
+
+        auto const level = y::simd::level();
+        for (auto lvl : { y::simd::Level::Scalar, y::simd::Level::Sse2, y::simd::Level::Avx2 }) {
+            y::simd::set_level(lvl);
+            auto const name = [](StrView title) {
+                return y_fmt("{} ({})", title, i32(y::simd::level()));
+            };
+            Vec<u8> mask(n), soa_mask(n), flags(a.size());
+            Vec<f32> out(a.size());
+
+            y::batch::fuzzy_eq(a, b, flags);
+            b8 ok = true;
+            for (usize i = 0; i < a.size(); ++i) {
+                ok &= flags[i] == y::fuzzy_eq(a[i], b[i]);
+            }
+            T.ok(name("Fuzzy Eq"), ok);
+
+            y::batch::fuzzy_eq(va, vb, mask, 5.f);
+            y::batch::fuzzy_eq(sa, sb, soa_mask, 5.f);
+            ok = mask == soa_mask;
+            for (usize i = 0; i < n; ++i) {
+                ok &= mask[i] == y::fuzzy_eq(va[i], vb[i], 5.f);
+            }
+            T.ok(name("Fuzzy Eq Vec3"), ok);
+
+            y::batch::is_aligned(va, vb, mask);
+            y::batch::is_aligned(sa, sb, soa_mask);
+            ok = mask == soa_mask && !mask[5] && mask[3];
+            for (usize i = 0; i < n; ++i) {
+                b8 const extreme = i >= extremes_at && i < extremes_at + extremes.size();
+                ok &= mask[i] == (extreme ? std::get<2>(extremes[i - extremes_at])
+                                          : u8(y::is_aligned(va[i], vb[i])));
+            }
+            T.ok(name("Is Aligned"), ok);
+
+            y::batch::clamp(a, out, -10.f, 10.f);
+            ok = true;
+            for (usize i = 0; i < a.size(); ++i) {
+                ok &= same(out[i], y::clamp(a[i], -10.f, 10.f));
+            }
+            T.ok(name("Clamp"), ok);
+
+            y::batch::map(a, out, -1000.f, 1000.f, 0.f, 1.f);
+            ok = true;
+            for (usize i = 0; i < a.size(); ++i) {
+                ok &= same(out[i], y::map(a[i], -1000.f, 1000.f, 0.f, 1.f));
+            }
+            T.ok(name("Map"), ok);
+
+            out = a;
+            y::batch::clamp_angle(out, out); // In place
+            ok = true;
+            for (usize i = 0; i < a.size(); ++i) {
+                ok &= same(out[i], y::clamp_angle(a[i]));
+            }
+            T.ok(name("Clamp Angle"), ok);
+        }
+        y::simd::set_level(level);
+    }
+
+
+    T.make_section("Thread Pool");
+    {
+        y::ThreadPool pool { 4 };
+        T.eq("Size", pool.size(), 4ul);
+
+        auto future = pool.submit([](i32 a, i32 b) { return a + b; }, 2, 3);
+        T.eq("Submit", future.get(), 5);
+
+        auto failing = pool.submit([] { throw std::runtime_error("boom"); });
+        T.test("Submit Exception", [&] {
+            try {
+                failing.get();
+            } catch (std::runtime_error const &) {
+                return true;
+            }
+            return false;
+        });
+
+        Vec<i32> values(10007, 0);
+        pool.parallel_for(0, values.size(), [&](usize i) { values[i] = i32(i); }, 64);
+        T.eq("Parallel For", values[10006], 10006);
+
+        pool.parallel_for(values, [](i32 &v) { v *= 2; });
+        T.eq("Parallel For Range", values[10006], 20012);
+
+        u64 const sum = pool.parallel_reduce(
+            0, 100001, u64(0), [](usize i) { return u64(i); }, std::plus<u64> {});
+        T.eq("Parallel Reduce", sum, 5000050000ul);
+
+        Str const joined = pool.parallel_reduce(
+            SpanConst<i32>(values).first(8), Str(), [](i32 v) { return y_fmt("{}", v); },
+            [](Str acc, Str const &v) { return acc + v; }, 1);
+        T.eq("Parallel Reduce Ordered", joined, "02468101214");
+
+        T.eq("Parallel Reduce Empty", pool.parallel_reduce(
+            5, 5, 7, [](usize) { return 1; }, std::plus<i32> {}), 7);
+
+        std::atomic<i32> nested = 0;
+        pool.parallel_for(0, 8, [&](usize) {
+            pool.parallel_for(0, 100, [&](usize) { ++nested; });
+        });
+        T.eq("Parallel For Nested", nested.load(), 800);
+
+        T.test("Parallel For Exception", [&] {
+            try {
+                pool.parallel_for(0, 100, [](usize i) {
+                    if (i == 42) {
+                        throw std::runtime_error("boom");
+                    }
+                });
+            } catch (std::runtime_error const &) {
+                return true;
+            }
+            return false;
+        });
+    }
+    {
+        y::nasty::stdout_off(); // Only its results are checked
+        y::Test P {};
+        P.set_parallel(4);
+        P.make_section("Parallel (Case 7 fails on purpose)");
+        for (i32 i = 0; i < 16; ++i) {
+            P.test(y_fmt("Case {}", i), [i] {
+                std::this_thread::sleep_for(std::chrono::milliseconds(16 - i));
+                return i != 7;
+            });
+        }
+        P.ok("Inline Check", true);
+
+        auto const results = P.results();
+        y::nasty::stdout_on();
+        T.eq("Parallel Test Count", results.size(), 17ul);
+        T.eq("Parallel Test Ordered", results[15].title, "Case 15");
+        T.ok("Parallel Test Failed", !results[7].passed && results[8].passed);
+        T.gt("Parallel Test Timings", results[0].elapsed_ns, results[15].elapsed_ns);
+        T.eq("Parallel Test Result", P.cli_result(), -1);
+        T.ok("Parallel Test Copyable",
+             std::is_copy_constructible_v<y::Test> && std::is_move_constructible_v<y::Test>);
+    }
+    {
+        y::nasty::stdout_off(); // Only its results are checked
+        y::Test P {};
+        P.set_parallel(4);
+        for (i32 i = 0; i < 8; ++i) {
+            P.test(y_fmt("Case {}", i), [&P, i] {
+                P.eq("Nested Check", i * 2, i + i);
+                return true;
+            });
+        }
+        P.test("Slow Case", [] {
+            std::this_thread::sleep_for(std::chrono::milliseconds(20));
+            return true;
+        });
+        y::Test copy = P; // Pending cases keep running for 'P' only
+
+        auto const results = P.results();
+        auto const copied = copy.results();
+        y::nasty::stdout_on();
+        T.eq("Parallel Test Nested Count", results.size(), 17ul);
+        T.eq("Parallel Test Nested Result", P.cli_result(), 0);
+        T.ok("Parallel Test Copy Pending", copied.size() < results.size());
+        T.eq("Parallel Test Copy Result", copy.cli_result(), 0);
     }
 
 
@@ -246,6 +710,94 @@ int main() {
         {
             T.ok("Extension", y::file_check_extension("./to_file_write.bin", "BiN"));
         }
+
+        {
+            auto constexpr s_writer_txt { "./tests/output/to_file_writer.txt" };
+
+            {
+                y::FileWriter writer { s_writer_txt, y::FileWriter::Mode::Overwrite, 16 };
+                T.ok("Writer Open", writer.is_open());
+                writer.preallocate(4096); // Only a hint, not available everywhere
+                for (i32 i = 0; i < 10; ++i) {
+                    writer.write(y_fmt("{},", i));
+                }
+                T.ok("Writer Big Record", writer.write(Str(64, 'x')));
+                T.ok("Writer Sync", writer.sync());
+                T.eq("Writer Bytes", writer.bytes_written(), 20ul + 64ul);
+            }
+            T.eq("Writer Read", y::file_read(s_writer_txt), "0,1,2,3,4,5,6,7,8,9," + Str(64, 'x'));
+
+            {
+                y::FileWriter writer { s_writer_txt, y::FileWriter::Mode::Overwrite, 1024, 1.0 };
+                Vec<u8> const bin { 'a', 'b' };
+                writer.write(bin);
+                T.ok("Writer Background Close", writer.close());
+                T.eq("Writer Background Flush", y::file_read(s_writer_txt), "ab");
+            }
+
+            {
+                y::FileWriter writer { s_writer_txt };
+                writer.write(Str("cd"));
+            }
+            T.eq("Writer Append On Close", y::file_read(s_writer_txt), "abcd");
+        }
+
+        {
+            y::MappedFile mapped { s_read_txt };
+            Str const expected = "Test\nFile\nFor\nTesting\nFile\nReading\n";
+            T.ok("Mapped Open", mapped.is_open());
+            T.eq("Mapped View", mapped.view(), expected);
+            T.ok("Mapped Advise", mapped.advise(y::MappedFile::Access::Sequential));
+            T.ok("Mapped Contains", y::str_contains(mapped, "Testing"));
+
+            Vec<u8> const magic { 'T', 'e', 's', 't' };
+            T.ok("Mapped Magic", y::bin_check_magic(mapped, magic));
+
+            y::MappedFile const moved = std::move(mapped);
+            T.ok("Mapped Move", moved.is_open() && !mapped.is_open());
+            T.ok("Mapped Missing", !y::MappedFile { "./tests/input/missing.txt" }.is_open());
+        }
+
+        {
+            Str content = "";
+            y::ChunkReader reader { s_read_txt, 4 };
+            for (auto chunk = reader.next(); !chunk.empty(); chunk = reader.next()) {
+                T.ok("Chunk Size", chunk.size() <= 4);
+                content.append((char const *)chunk.data(), chunk.size());
+            }
+            T.eq("Chunked Read", content, y::file_read(s_read_txt));
+            T.eq("Chunked Offset", reader.offset(), content.size());
+        }
+    }
+
+
+    T.make_section("Benchmark");
+    {
+        auto constexpr s_bench_csv { "./tests/output/benchmark.csv" };
+
+        y::Benchmark B {};
+        B.set_samples(9);
+        B.set_min_sample_time_ms(0.5);
+
+        auto const stats = B.run("Sum", [] {
+            u64 acc = 0;
+            for (u64 i = 0; i < 64; ++i) {
+                acc += i;
+                y::do_not_optimize(acc);
+            }
+            return acc;
+        });
+        T.ok("Calibrated", stats.iterations > 1);
+        T.eq("Samples", stats.samples, 9u);
+        T.ok("Stats Order", stats.min_ns <= stats.median_ns && stats.median_ns <= stats.p90_ns &&
+                                stats.p90_ns <= stats.p99_ns);
+
+        B.run("Fixed", 10, [] { y::clobber_memory(); });
+        T.eq("Fixed Iterations", B.results().back().iterations, 10u);
+
+        T.ok("JSON", y::str_contains(B.to_json(), "\"median_ns\": "));
+        T.ok("Save CSV", B.save_csv(s_bench_csv));
+        T.ok("Compare Baseline", B.compare(s_bench_csv, 0.0));
     }
 
 
@@ -0,0 +1,78 @@
+#define yyEnable_Aliases
+#define yyEnable_Testing
+#define yyEnable_Tracing
+#define yyDisable_LogFileAndLine
+#include <y.hpp>
+
+static void traced_work(i32 depth) {
+    y_trace_scope("traced_work");
+    if (depth > 0) {
+        traced_work(depth - 1);
+    }
+}
+
+int main() {
+
+    y::Test T {};
+
+
+    T.make_section("Tracing");
+    {
+        T.ok("Ticks Monotonic", y::ticks() <= y::ticks());
+        T.ok("Ticks To Ns", y::ticks_to_ns() > 0.0);
+
+        for (i32 i = 0; i < 10; ++i) {
+            traced_work(2);
+        }
+        {
+            y_trace_scope("sleep");
+            std::this_thread::sleep_for(std::chrono::milliseconds(2));
+        }
+        y_trace_counter("queue_size", 42);
+        y_trace_counter("ratio", std::numeric_limits<f64>::quiet_NaN());
+        y_trace_counter("limit", std::numeric_limits<f64>::infinity());
+
+        auto const summary = y::trace_summary();
+        T.eq("Summary Scopes", summary.size(), 2ul);
+        T.eq("Summary Sorted", summary[0].name, "sleep");
+        T.gt("Summary Total", summary[0].total_ns, 1e6);
+        T.eq("Summary Count", summary[1].count, 30ul);
+        T.ok("Summary Max", summary[1].max_ns >= summary[1].mean_ns);
+
+        Vec<std::thread> threads {};
+        for (i32 t = 0; t < 4; ++t) {
+            threads.emplace_back([] {
+                for (i32 i = 0; i < 1000; ++i) {
+                    y_trace_scope("thread_work");
+                }
+            });
+        }
+        for (auto &thread : threads) {
+            thread.join();
+        }
+        auto const scopes = y::trace_summary();
+        auto const work = std::find_if(scopes.begin(), scopes.end(), [](auto const &scope) {
+            return scope.name == "thread_work";
+        });
+        T.ok("Many Threads Found", work != scopes.end());
+        T.eq("Many Threads", work != scopes.end() ? work->count : 0ul, 4000ul);
+
+        Str const json = y::trace_to_json();
+        T.ok("Json Complete Event", y::str_contains(json, R"("name":"sleep","ph":"X")"));
+        T.ok("Json Counter Event", y::str_contains(json, R"("args":{"value":42})"));
+        T.ok("Json Counter NaN", y::str_contains(json, R"("name":"ratio")") &&
+                                     !y::str_contains(json, "nan"));
+        T.ok("Json Counter Inf", !y::str_contains(json, "inf") &&
+                                     y::str_contains(json, R"("args":{"value":null})"));
+        T.ok("Json Threads", y::str_contains(json, R"("tid":5)"));
+        T.ok("Json Save", y::trace_save_json("./tests/output/trace.json"));
+
+        y::trace_clear();
+        T.eq("Clear", y::trace_summary().size(), 0ul);
+        T.eq("Dropped", y::trace_dropped(), 0ul);
+    }
+
+
+    T.show_results();
+    return T.cli_result();
+}